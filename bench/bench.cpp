@@ -0,0 +1,389 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : bench.cpp                                                   |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#include "generator.hpp"
+#include "cmodel.hpp"
+#include "packedarray.hpp"
+#include "eliasfano.hpp"
+#include "bloomfilter.hpp"
+#include "ngram.hpp"
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <set>
+#include <sstream>
+#include <fstream>
+#include <ctime>
+#include <stdint.h>
+
+using namespace std;
+
+// number of times the whole set of n-grams is looked up
+const int LOOKUP_ROUNDS = 20;
+// number of language instances produced with each model
+const int PRODUCTIONS = 200;
+// number of n-grams whose histories are looked up, along with as many
+// unseen ones
+const size_t HISTORY_SAMPLE = 1000;
+// target false positive rate of the Bloom filter of histories
+const double FILTER_FPR = 0.01;
+
+map<string, string> getOptionMap(int argc, const char* argv[]) {
+    map<string, string> optMap;
+    if (((argc - 1) % 2) == 0) {
+        for (int optc = 1; optc < argc; optc += 2) {
+            optMap[argv[optc]] = argv[optc + 1];
+        }
+    }
+    return optMap;
+}
+
+void printSynopsis() {
+    cout << endl;
+    cout << "NLG language model benchmark" << endl;
+    cout << "----------------------------" << endl;
+    cout << "Usage: nlg-bench PARAMETERS" << endl;
+    cout << "\t-n ORDER: the order of the language model." << endl;
+    cout << "\t-t FILE: the training file." << endl;
+    cout << endl;
+    cout << "Then, nlg-bench will compare the memory taken by the plain " <<
+        "and the compressed" << endl << "models against their lookup " <<
+        "and production latencies, and the history" << endl <<
+        "lookup latencies with and without a Bloom filter." << endl << endl;
+}
+
+// the rb-tree node of a map adds a colour and three links to each entry
+size_t plainBytes(const map<ngram, int> &freq) {
+    size_t bytes = sizeof(map<ngram, int>);
+    map<ngram, int>::const_iterator ngit;
+    for (ngit = freq.begin(); ngit != freq.end(); ngit++) {
+        bytes += 4 * sizeof(void*) + sizeof(pair<const ngram, int>);
+        const vector<string> *grams = (ngit->first).getGramList();
+        vector<string>::const_iterator it;
+        for (it = grams->begin(); it != grams->end(); it++) {
+            bytes += sizeof(string) + it->size();
+        }
+    }
+    return bytes;
+}
+
+double nanosPer(clock_t start, clock_t end, size_t ops) {
+    return (double)(end - start) * 1e9 / CLOCKS_PER_SEC / (double)ops;
+}
+
+double timeProductions(generator &gen) {
+    clock_t start = clock();
+    for (int prod = 0; prod < PRODUCTIONS; prod++) {
+        gen.produce();
+    }
+    return (double)(clock() - start) * 1e3 / CLOCKS_PER_SEC / PRODUCTIONS;
+}
+
+void printRow(const string &model, size_t bytes, size_t size,
+        double lookup, double production) {
+    cout << left << setw(12) << model << right << fixed <<
+        setw(14) << bytes <<
+        setw(14) << setprecision(2) << (double)bytes / (double)size <<
+        setw(14) << setprecision(1) << lookup <<
+        setw(14) << setprecision(3) << production << endl;
+}
+
+bool plainHistory(const map<ngram, int> &freq, const ngram &hist) {
+    map<ngram, int>::const_iterator it = freq.lower_bound(hist);
+    return (it != freq.end()) && (it->first == hist);
+}
+
+// linear congruential generator, so the checks are reproducible
+uint64_t nextRand(uint64_t &state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 11;
+}
+
+bool checkPacked(const string &name, const vector<uint64_t> &values) {
+    packedarray packed(values);
+    if (packed.getSize() != values.size()) {
+        cout << "Codec check failed: " << name << " size" << endl;
+        return false;
+    }
+    for (size_t pos = 0; pos < values.size(); pos++) {
+        if (packed.get(pos) != values[pos]) {
+            cout << "Codec check failed: " << name << " at " << pos << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkEliasFano(const string &name, const vector<uint64_t> &values) {
+    eliasfano coded(values);
+    if (coded.getSize() != values.size()) {
+        cout << "Codec check failed: " << name << " size" << endl;
+        return false;
+    }
+    for (size_t pos = 0; pos < values.size(); pos++) {
+        if (coded.get(pos) != values[pos]) {
+            cout << "Codec check failed: " << name << " at " << pos << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// decodes every element of the succinct codecs, since the count
+// checksum of the lookups could hide offsetting errors
+bool checkCodecs() {
+    uint64_t state = 1;
+    vector<uint64_t> straddling, full, single, dense, sparse, sampled;
+    // 7-bit elements do not divide 64, so many straddle two words
+    for (int pos = 0; pos < 1000; pos++) {
+        straddling.push_back(nextRand(state) % 128);
+    }
+    straddling.push_back(127);
+    for (int pos = 0; pos < 300; pos++) {
+        full.push_back((nextRand(state) << 11) ^ nextRand(state));
+    }
+    full.push_back(~(uint64_t)0);
+    for (int pos = 0; pos < 130; pos++) {
+        single.push_back(nextRand(state) % 2);
+    }
+    // fewer distinct values than elements, hence no low bits
+    for (int pos = 0; pos < 1000; pos++) {
+        dense.push_back(pos / 3);
+    }
+    // large gaps yield 13-bit low parts, which straddle words as well
+    uint64_t value = 0;
+    for (int pos = 0; pos < 1000; pos++) {
+        value += nextRand(state) % 16384;
+        sparse.push_back(value);
+    }
+    // runs of repeated values and long gaps span several sample blocks
+    value = 0;
+    for (int pos = 0; pos < 5000; pos++) {
+        if ((nextRand(state) % 4) == 0) {
+            value += nextRand(state) % (((pos / 500) % 2) ? 3 : 100000);
+        }
+        sampled.push_back(value);
+    }
+    vector<uint64_t> one(1, 42);
+    return checkPacked("packedarray width 7", straddling) &&
+        checkPacked("packedarray width 64", full) &&
+        checkPacked("packedarray width 1", single) &&
+        checkEliasFano("eliasfano dense", dense) &&
+        checkEliasFano("eliasfano sparse", sparse) &&
+        checkEliasFano("eliasfano sampled", sampled) &&
+        checkEliasFano("eliasfano single", one);
+}
+
+// lookups go through the generator, so they include its filter check
+// and the very same search of the n-gram counts as the predictions
+double timeObserved(generator &gen, const vector<ngram> &hists,
+        int rounds) {
+    size_t found = 0;
+    gen.resetFilterCounters();
+    clock_t start = clock();
+    for (int round = 0; round < rounds; round++) {
+        for (size_t h = 0; h < hists.size(); h++) {
+            found += gen.isObserved(hists[h]);
+        }
+    }
+    clock_t end = clock();
+    // keeps the lookups from being optimised away
+    if (found == (size_t)-1) {
+        cout << endl;
+    }
+    return nanosPer(start, end, hists.size() * rounds);
+}
+
+// the plain search scans the map linearly, so it is timed once, and its
+// filter counters are reported
+void printFilterRow(const string &name, generator &plain,
+        generator &packed, const vector<ngram> &hists) {
+    double plainNanos = timeObserved(plain, hists, 1);
+    const bloomfilter *filter = plain.getFilter();
+    cout << left << setw(12) << name << right;
+    if (plain.isFiltered()) {
+        cout << setw(12) << filter->getBits() / 8 <<
+            setw(8) << filter->getHashes() <<
+            setw(10) << filter->getQueries() <<
+            setw(10) << filter->getRejections() <<
+            setw(12) << filter->getFalsePositives();
+    } else {
+        cout << setw(12) << "-" << setw(8) << "-" << setw(10) << "-" <<
+            setw(10) << "-" << setw(12) << "-";
+    }
+    cout << fixed << setprecision(1) << setw(12) << plainNanos <<
+        setw(12) << timeObserved(packed, hists, LOOKUP_ROUNDS) << endl;
+}
+
+// half of the histories are observed; the other half are random token
+// tuples that were never observed, or else, if no such tuple turns up
+// after a few draws, observed histories whose newest token is replaced
+// by an out-of-vocabulary one (the tokeniser never yields a '#')
+void benchFilter(const generator &trained, const vector<ngram> &queries) {
+    int order = trained.getOrder();
+    const map<ngram, int> &freq = *trained.getFreq();
+    set<string> tokens;
+    for (size_t q = 0; q < queries.size(); q++) {
+        const vector<string> *grams = queries[q].getGramList();
+        tokens.insert(grams->begin(), grams->end());
+    }
+    vector<string> vocab(tokens.begin(), tokens.end());
+    vector<ngram> hists;
+    uint64_t state = 1;
+    size_t outOfVocab = 0;
+    size_t stride = (queries.size() + HISTORY_SAMPLE - 1) / HISTORY_SAMPLE;
+    for (size_t q = 0; q < queries.size(); q += stride) {
+        const vector<string> *grams = queries[q].getGramList();
+        vector<string> hist(grams->begin(), grams->end() - 1);
+        hists.push_back(ngram(hist));
+        bool found = false;
+        for (int draw = 0; (draw < 8) && !found; draw++) {
+            for (int pos = 0; pos < order - 1; pos++) {
+                hist[pos] = vocab[nextRand(state) % vocab.size()];
+            }
+            found = !plainHistory(freq, ngram(hist));
+        }
+        if (!found) {
+            ostringstream oov;
+            oov << "oov#" << q;
+            hist[order - 2] = oov.str();
+            outOfVocab++;
+        }
+        hists.push_back(ngram(hist));
+    }
+    size_t seenHists = 0;
+    for (size_t h = 0; h < hists.size(); h++) {
+        seenHists += plainHistory(freq, hists[h]);
+    }
+    cout << endl << "Histories: " << hists.size() << ", unseen: " <<
+        (hists.size() - seenHists) << " (" << fixed << setprecision(1) <<
+        100.0 * (hists.size() - seenHists) / hists.size() <<
+        "%), out-of-vocabulary: " << outOfVocab << endl;
+    generator unfiltered(trained);
+    generator packed(trained);
+    packed.compress();
+    generator filtered(trained);
+    filtered.buildFilter(FILTER_FPR, 0);
+    generator packedFiltered(filtered);
+    packedFiltered.compress();
+    // the capped filter gets a quarter of the bit array it would need
+    generator capped(trained);
+    capped.buildFilter(FILTER_FPR,
+        filtered.getFilter()->getBits() / 8 / 4);
+    generator packedCapped(capped);
+    packedCapped.compress();
+    cout << left << setw(12) << "filter" << right <<
+        setw(12) << "array bytes" << setw(8) << "hashes" <<
+        setw(10) << "queries" << setw(10) << "rejected" <<
+        setw(12) << "false pos." <<
+        setw(12) << "plain (ns)" << setw(12) << "comp. (ns)" << endl;
+    printFilterRow("none", unfiltered, packed, hists);
+    printFilterRow("full", filtered, packedFiltered, hists);
+    printFilterRow("quarter", capped, packedCapped, hists);
+}
+
+int main(int argc, const char* argv[]) {
+    if (argc != 5) {
+        printSynopsis();
+        return EXIT_FAILURE;
+    }
+    if (!checkCodecs()) {
+        return EXIT_FAILURE;
+    }
+    cout << "Codec checks passed." << endl;
+    map<string, string> opts = getOptionMap(argc, argv);
+    generator gen(atoi(opts["-n"].c_str()));
+    ifstream training(opts["-t"].c_str());
+    if (!training.good()) {
+        cout << "Bad training file!" << endl;
+        return EXIT_FAILURE;
+    }
+    string line;
+    getline(training, line);
+    while (!training.eof()) {
+        gen.feed(line);
+        getline(training, line);
+    }
+    training.close();
+    const map<ngram, int> *freq = gen.getFreq();
+    vector<ngram> queries;
+    map<ngram, int>::const_iterator ngit;
+    for (ngit = freq->begin(); ngit != freq->end(); ngit++) {
+        queries.push_back(ngit->first);
+    }
+    if (queries.empty()) {
+        cout << "Empty training file!" << endl;
+        return EXIT_FAILURE;
+    }
+    cout << "Order: " << gen.getOrder() << ", n-grams: " <<
+        queries.size() << endl;
+    size_t lookups = queries.size() * LOOKUP_ROUNDS;
+    cmodel packed(*freq, gen.getOrder());
+    // checksums keep the lookups from being optimised away
+    long long plainSum = 0, packedSum = 0;
+    clock_t start = clock();
+    for (int round = 0; round < LOOKUP_ROUNDS; round++) {
+        for (size_t q = 0; q < queries.size(); q++) {
+            plainSum += freq->find(queries[q])->second;
+        }
+    }
+    double plainLookup = nanosPer(start, clock(), lookups);
+    start = clock();
+    for (int round = 0; round < LOOKUP_ROUNDS; round++) {
+        for (size_t q = 0; q < queries.size(); q++) {
+            packedSum += packed.getCount(queries[q]);
+        }
+    }
+    double packedLookup = nanosPer(start, clock(), lookups);
+    if (plainSum != packedSum) {
+        cout << "Mismatching counts between models!" << endl;
+        return EXIT_FAILURE;
+    }
+    size_t plainSize = plainBytes(*freq);
+    // the filters are built on copies, so the productions go unfiltered
+    if (gen.getOrder() > 1) {
+        benchFilter(gen, queries);
+    }
+    double plainProduction = timeProductions(gen);
+    gen.compress();
+    double packedProduction = timeProductions(gen);
+    cout << endl << left << setw(12) << "model" << right <<
+        setw(14) << "bytes" << setw(14) << "bytes/n-gram" <<
+        setw(14) << "lookup (ns)" << setw(14) << "produce (ms)" << endl;
+    printRow("plain", plainSize, queries.size(), plainLookup,
+        plainProduction);
+    printRow("compressed", packed.getBytes(), queries.size(),
+        packedLookup, packedProduction);
+    return EXIT_SUCCESS;
+}
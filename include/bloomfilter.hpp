@@ -0,0 +1,174 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : bloomfilter.hpp                                             |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#ifndef BLOOMFILTER_HPP
+#define BLOOMFILTER_HPP
+
+#include "ngram.hpp"
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * @class bloomfilter
+ * @brief Probabilistic set of n-grams that answers membership queries
+ *     with no false negatives and a bounded rate of false positives.
+ *
+ * Each n-gram sets <i>k</i> bits of an array of <i>m</i> bits. If any of
+ * the bits of a queried n-gram is unset, the n-gram was definitely never
+ * inserted. Otherwise, it may have been inserted, and the main tables
+ * have to be searched. For <i>n</i> items and a target false positive
+ * rate <i>p</i>, the array takes m = -n ln(p) / ln(2)^2 bits and
+ * k = (m / n) ln(2) hashes (Bloom, 1970). The <i>k</i> hashes are derived
+ * from two base hashes (Kirsch and Mitzenmacher, 2006).
+ *
+ * In NLG it keeps the observed histories of the {@link generator}, so the
+ * unseen ones are rejected without searching the n-gram counts. It also
+ * counts its queries, the rejections and the reported false positives in
+ * order to assess its benefit.
+ *
+ * --<br>
+ * [Bloom, 1970] Bloom, B. H., "Space/Time Trade-offs in Hash Coding with
+ * Allowable Errors", Communications of the ACM, 13(7), pp. 422-426,
+ * 1970.<br>
+ * [Kirsch and Mitzenmacher, 2006] Kirsch, A. and Mitzenmacher, M., "Less
+ * Hashing, Same Performance: Building a Better Bloom Filter", Proceedings
+ * of the 14th European Symposium on Algorithms, pp. 456-467, 2006.
+ *
+ * @author agent
+ */
+class bloomfilter {
+    public:
+        /**
+         * @brief Plain empty constructor.
+         */
+        bloomfilter();
+        /**
+         * @brief Parametric constructor that sizes the filter.
+         * @param items The expected number of items.
+         * @param fpr The target false positive rate, between 0 and 1. It
+         *     is clamped to that range, and to no less than 1e-9.
+         * @param maxBytes The maximum memory taken by the bit array, 0
+         *     for no limit. If the limit applies, the actual false
+         *     positive rate is higher than the target. The bookkeeping
+         *     of the filter itself is not included.
+         */
+        bloomfilter(size_t items, double fpr, size_t maxBytes);
+        /**
+         * @brief Inserts an n-gram.
+         * @param ng The n-gram to insert.
+         */
+        void insert(const ngram &ng);
+        /**
+         * @brief Tests the membership of an n-gram. It counts the query,
+         *     and the rejection if so.
+         * @param ng The n-gram to test.
+         * @return False if the n-gram was definitely not inserted, true if
+         *     it may have been inserted.
+         */
+        bool contains(const ngram &ng);
+        /**
+         * @brief Records that a query that passed the filter was not found
+         *     in the main tables.
+         */
+        void reportFalsePositive();
+        /**
+         * @brief Sets all the counters to zero.
+         */
+        void resetCounters();
+        /**
+         * @brief Retrieves the number of queries.
+         * @return The number of queries.
+         */
+        size_t getQueries() const;
+        /**
+         * @brief Retrieves the number of queries that were rejected.
+         * @return The number of rejections.
+         */
+        size_t getRejections() const;
+        /**
+         * @brief Retrieves the number of reported false positives.
+         * @return The number of false positives.
+         */
+        size_t getFalsePositives() const;
+        /**
+         * @brief Retrieves the number of bits of the array.
+         * @return The number of bits.
+         */
+        size_t getBits() const;
+        /**
+         * @brief Retrieves the number of hashes per item.
+         * @return The number of hashes.
+         */
+        int getHashes() const;
+        /**
+         * @brief Retrieves the memory taken by the filter, i.e., its bit
+         *     array along with its bookkeeping.
+         * @return The number of bytes.
+         */
+        size_t getBytes() const;
+    private:
+        /**
+         * @brief The bit array.
+         */
+        vector<uint8_t> bits;
+        /**
+         * @brief Number of bits of the array.
+         */
+        size_t nbits;
+        /**
+         * @brief Number of hashes per item.
+         */
+        int nhashes;
+        /**
+         * @brief Number of queries.
+         */
+        size_t queries;
+        /**
+         * @brief Number of rejected queries.
+         */
+        size_t rejections;
+        /**
+         * @brief Number of reported false positives.
+         */
+        size_t falsePositives;
+        /**
+         * @brief Computes the two base hashes of an n-gram.
+         * @param ng The given n-gram.
+         * @param h1 The first base hash.
+         * @param h2 The second base hash, always odd.
+         */
+        static void hash(const ngram &ng, uint64_t &h1, uint64_t &h2);
+};
+
+#endif
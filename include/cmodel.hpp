@@ -0,0 +1,206 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : cmodel.hpp                                                  |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#ifndef CMODEL_HPP
+#define CMODEL_HPP
+
+#include "ngram.hpp"
+#include "packedarray.hpp"
+#include "eliasfano.hpp"
+#include <string>
+#include <vector>
+#include <map>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * @class cmodel
+ * @brief Read-only compressed representation of the n-gram counts of a
+ *     Language Model (LM), which supports lookups and predictions without
+ *     being decompressed.
+ *
+ * The tokens are mapped to integer identifiers following their
+ * lexicographical order, so the sorted n-grams of an LM of order
+ * <i>n</i> are laid out as a trie of <i>n</i> levels. The level <i>k</i>
+ * keeps the last identifier of every distinct (k+1)-gram prefix in a
+ * {@link packedarray packed array}, and the children of each node are
+ * delimited by a monotone sequence of pointers that is coded with
+ * {@link eliasfano Elias-Fano}. Since the siblings are sorted, each level
+ * of a lookup is solved with a binary search within the range of the
+ * parent node.
+ *
+ * Most n-grams share a handful of distinct count values, so the counts
+ * are stored as the rank of each value in a table of distinct counts,
+ * sorted by decreasing number of occurrences, and only the ranks are
+ * kept for every n-gram (Pibiri and Venturini, 2017).
+ *
+ * --<br>
+ * [Pibiri and Venturini, 2017] Pibiri, G. E. and Venturini, R.,
+ * "Efficient Data Structures for Massive N-Gram Datasets", Proceedings of
+ * the 40th ACM SIGIR Conference, pp. 615-624, 2017.
+ *
+ * @author agent
+ */
+class cmodel {
+    public:
+        /**
+         * @brief Plain empty constructor.
+         */
+        cmodel();
+        /**
+         * @brief Parametric constructor that compresses a set of observed
+         *     n-grams.
+         * @param freq The observed n-grams along with their frequencies.
+         *     All of them must be of the given order.
+         * @param ord The order of the LM.
+         */
+        cmodel(const map<ngram, int> &freq, int ord);
+        /**
+         * @brief Retrieves the order of the LM.
+         * @return The order of the LM.
+         */
+        int getOrder() const;
+        /**
+         * @brief Retrieves the number of n-grams of the LM.
+         * @return The number of n-grams.
+         */
+        size_t getSize() const;
+        /**
+         * @brief Retrieves the memory taken by the LM, vocabulary included.
+         * @return The number of bytes.
+         */
+        size_t getBytes() const;
+        /**
+         * @brief Looks up the frequency of an n-gram.
+         * @param ng The n-gram to look up. Must be of the order of the LM.
+         * @return The frequency of the n-gram, zero if it was not observed.
+         */
+        int getCount(const ngram &ng) const;
+        /**
+         * @brief Looks up the outcomes observed after a history.
+         * @param hist The given history, i.e., the n-1 tokens that
+         *     precede the outcome.
+         * @param first The first n-gram that follows the history.
+         * @param last The n-gram past the end of those that follow the
+         *     history.
+         * @return True if the history was observed.
+         */
+        bool findHistory(const ngram &hist, size_t &first,
+            size_t &last) const;
+        /**
+         * @brief Collects all the distinct histories of the LM, i.e., the
+         *     observed n-grams without their newest token.
+         * @param hists The container where the histories are appended.
+         */
+        void getHistories(vector<ngram> &hists) const;
+        /**
+         * @brief Draws the newest token of an n-gram from a range of
+         *     n-grams according to their frequencies.
+         *
+         * The outcomes are sampled like in the {@link generator}, so the
+         * whole LM, from 0 to the size of the LM, is to be used if the
+         * history was not observed.
+         *
+         * @param first The first n-gram of the range.
+         * @param last The n-gram past the end of the range.
+         * @param rnd A pseudo random number.
+         * @return The drawn token.
+         */
+        string sample(size_t first, size_t last, int rnd) const;
+    private:
+        /**
+         * @brief Tokens sorted lexicographically, indexed by identifier.
+         */
+        vector<string> vocab;
+        /**
+         * @brief Token identifiers of every level of the trie.
+         */
+        vector<packedarray> ids;
+        /**
+         * @brief Child pointers of every level of the trie but the last.
+         */
+        vector<eliasfano> ptrs;
+        /**
+         * @brief Rank of the count of every n-gram.
+         */
+        packedarray ranks;
+        /**
+         * @brief Distinct counts, indexed by rank.
+         */
+        vector<int> counts;
+        /**
+         * @brief Order of the n-gram-based LM.
+         */
+        int order;
+        /**
+         * @brief Retrieves the identifier of a token.
+         * @param token The given token.
+         * @param id The identifier of the token, if found.
+         * @return True if the token belongs to the vocabulary.
+         */
+        bool findToken(const string &token, uint64_t &id) const;
+        /**
+         * @brief Searches a token among a range of siblings of the trie.
+         * @param level The level of the trie.
+         * @param first The first node of the range.
+         * @param last The node past the end of the range.
+         * @param id The identifier of the token.
+         * @param pos The node of the token, if found.
+         * @return True if the token is found within the range.
+         */
+        bool findChild(int level, size_t first, size_t last,
+            uint64_t id, size_t &pos) const;
+        /**
+         * @brief Walks down the trie along the oldest tokens of an n-gram.
+         * @param ng The n-gram that contains the path.
+         * @param depth The number of tokens to walk along.
+         * @param first The first node of the range of children reached.
+         * @param last The node past the end of the range of children.
+         * @return True if the whole path is found.
+         */
+        bool descend(const ngram &ng, int depth, size_t &first,
+            size_t &last) const;
+        /**
+         * @brief Collects the paths of the trie down to a given depth.
+         * @param level The level of the nodes to walk along.
+         * @param first The first node of the range.
+         * @param last The node past the end of the range.
+         * @param depth The length of the paths to collect.
+         * @param path The tokens of the path walked so far.
+         * @param hists The container where the paths are appended.
+         */
+        void collect(int level, size_t first, size_t last, int depth,
+            vector<string> &path, vector<ngram> &hists) const;
+};
+
+#endif
@@ -0,0 +1,126 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : eliasfano.hpp                                               |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#ifndef ELIASFANO_HPP
+#define ELIASFANO_HPP
+
+#include "packedarray.hpp"
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * @class eliasfano
+ * @brief Read-only Elias-Fano encoding of a non-decreasing sequence of
+ *     unsigned integers.
+ *
+ * Given <i>n</i> values bounded by <i>u</i>, each value is split into
+ * its <i>l</i> = floor(log2(u/n)) lowest bits, which are stored verbatim
+ * in a {@link packedarray packed array}, and its remaining highest bits,
+ * which are stored in unary as gaps over a bit vector of
+ * <i>n</i> + u/2^l bits. This takes less than 2 + log2(u/n) bits per
+ * value (Elias, 1974; Fano, 1971). Random access requires locating the
+ * i-th set bit of the bit vector, which is sped up by sampling the
+ * position of every 64th set bit.
+ *
+ * In NLG this sequence keeps the monotone child pointers of the
+ * {@link cmodel compressed model}.
+ *
+ * --<br>
+ * [Elias, 1974] Elias, P., "Efficient Storage and Retrieval by Content
+ * and Address of Static Files", Journal of the ACM, 21(2), pp. 246-260,
+ * 1974.<br>
+ * [Fano, 1971] Fano, R. M., "On the Number of Bits Required to Implement
+ * an Associative Memory", Memorandum 61, Computer Structures Group,
+ * Project MAC, MIT, Cambridge, MA, USA, 1971.
+ *
+ * @author agent
+ */
+class eliasfano {
+    public:
+        /**
+         * @brief Plain empty constructor.
+         */
+        eliasfano();
+        /**
+         * @brief Parametric constructor that encodes the given sequence.
+         * @param values The sequence to encode. Must be non-decreasing.
+         */
+        eliasfano(const vector<uint64_t> &values);
+        /**
+         * @brief Retrieves an element of the sequence.
+         * @param pos The position of the desired element. Must be lower
+         *     than the size of the sequence.
+         * @return The element in the given position.
+         */
+        uint64_t get(size_t pos) const;
+        /**
+         * @brief Retrieves the number of elements of the sequence.
+         * @return The number of elements.
+         */
+        size_t getSize() const;
+        /**
+         * @brief Retrieves the memory taken by the sequence.
+         * @return The number of bytes.
+         */
+        size_t getBytes() const;
+    private:
+        /**
+         * @brief Lowest bits of the elements.
+         */
+        packedarray low;
+        /**
+         * @brief Highest bits of the elements, coded in unary.
+         */
+        vector<uint64_t> high;
+        /**
+         * @brief Position in the high bits of every 64th set bit.
+         */
+        vector<uint64_t> samples;
+        /**
+         * @brief Number of elements.
+         */
+        size_t size;
+        /**
+         * @brief Number of lowest bits of each element.
+         */
+        int lowWidth;
+        /**
+         * @brief Locates a set bit in the high bits.
+         * @param rank The rank of the desired set bit, starting at zero.
+         * @return The position of the set bit.
+         */
+        uint64_t select(size_t rank) const;
+};
+
+#endif
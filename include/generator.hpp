@@ -33,6 +33,8 @@
 #define GENERATOR_HPP
 
 #include "ngram.hpp"
+#include "cmodel.hpp"
+#include "bloomfilter.hpp"
 #include <string>
 #include <map>
 
@@ -80,6 +82,12 @@ using namespace std;
  * unigram Language Model (LM), aka Bag-Of-Words model, instead of 
  * smoothing all the probabilities.
  *
+ * Once the training is over, the n-gram counts may be packed into a
+ * read-only {@link cmodel compressed model}, which then serves all the
+ * predictions. Likewise, a {@link bloomfilter Bloom filter} of the
+ * observed histories may be built in order to reject the unseen ones
+ * without searching the n-gram counts.
+ *
  * --<br>
  * [Manning and Schutze, 1999] Manning, C. D. and Schutze, H.,
  * "Foundations of Statistical Natural Language Processing", Cambridge, 
@@ -109,10 +117,78 @@ class generator {
          */
         int getOrder() const;
         /**
-         * @brief Inputs an instance of training data.
+         * @brief Inputs an instance of training data. It has no effect
+         *     once the LM is compressed.
          * @param food The instance of training data.
          */
         void feed(const string &food);
+        /**
+         * @brief Packs the observed n-grams into a compressed model and
+         *     releases the original container. The LM becomes read-only.
+         */
+        void compress();
+        /**
+         * @brief Indicates if the LM is compressed.
+         * @return True if the LM is compressed.
+         */
+        bool isCompressed() const;
+        /**
+         * @brief Retrieves the observed n-grams along with their
+         *     frequencies. It is empty once the LM is compressed.
+         * @return The observed n-grams.
+         */
+        const map<ngram, int>* getFreq() const;
+        /**
+         * @brief Retrieves the compressed model.
+         * @return The compressed model, empty unless the LM is compressed.
+         */
+        const cmodel* getCompressed() const;
+        /**
+         * @brief Builds a Bloom filter of the observed histories, which
+         *     is checked before searching the n-gram counts. It has no
+         *     effect on a unigram LM, nor if the false positive rate is
+         *     out of range.
+         *
+         * The histories fed afterwards are inserted into the filter as
+         * well, so it never rejects an observed history, but its false
+         * positive rate grows beyond the target.
+         *
+         * Since produce() only follows observed histories, the filter
+         * rejects nothing there and just adds a hash to each prediction.
+         * It pays off for lookups of unseen histories, like the ones of
+         * isObserved() in scoring workloads.
+         *
+         * @param fpr The target false positive rate, strictly between 0
+         *     and 1.
+         * @param maxBytes The maximum memory taken by the bit array of
+         *     the filter, 0 for no limit.
+         */
+        void buildFilter(double fpr, size_t maxBytes);
+        /**
+         * @brief Indicates if the histories are filtered.
+         * @return True if the Bloom filter is built.
+         */
+        bool isFiltered() const;
+        /**
+         * @brief Retrieves the Bloom filter of the observed histories,
+         *     along with its counters.
+         * @return The Bloom filter, empty unless it is built.
+         */
+        const bloomfilter* getFilter() const;
+        /**
+         * @brief Sets the counters of the Bloom filter to zero.
+         */
+        void resetFilterCounters();
+        /**
+         * @brief Indicates if a history was observed in the training
+         *     data, searching the n-gram counts like the predictions do.
+         *     The Bloom filter, if built, is checked first.
+         * @param hist The given history, i.e., the n-1 tokens that
+         *     precede the outcome.
+         * @return True if the history was observed. Always true for a
+         *     unigram LM, which does not depend on the history.
+         */
+        bool isObserved(const ngram &hist);
         /**
          * @brief Outputs a language instance.
          * @return A language instance.
@@ -124,6 +200,23 @@ class generator {
          *     along with their frequencies.
          */
         map<ngram, int> freq;
+        /**
+         * @brief Compressed counterpart of the observed n-grams.
+         */
+        cmodel cfreq;
+        /**
+         * @brief Whether the predictions are served by the compressed
+         *     model.
+         */
+        bool compressed;
+        /**
+         * @brief Bloom filter of the observed histories.
+         */
+        bloomfilter filter;
+        /**
+         * @brief Whether the histories are checked against the filter.
+         */
+        bool filtered;
         /**
          * @brief Order of the n-gram-based LM.
          */
@@ -155,6 +248,12 @@ class generator {
          * @return The predicted token.
          */
         string predict(const ngram &hist);
+        /**
+         * @brief Checks a history against the Bloom filter, if built.
+         * @param hist The given history.
+         * @return False if the history was definitely not observed.
+         */
+        bool mayBeObserved(const ngram &hist);
 };
 
 #endif
@@ -0,0 +1,111 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : packedarray.hpp                                             |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#ifndef PACKEDARRAY_HPP
+#define PACKEDARRAY_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * @class packedarray
+ * @brief Read-only array of unsigned integers where every element takes
+ *     exactly as many bits as the largest one needs.
+ *
+ * The elements are laid out contiguously over a sequence of 64-bit words,
+ * so an element may straddle two words. It is the basic building block of
+ * the {@link cmodel compressed model}, where it holds the word identifiers
+ * and the count ranks.
+ *
+ * @author agent
+ */
+class packedarray {
+    public:
+        /**
+         * @brief Plain empty constructor.
+         */
+        packedarray();
+        /**
+         * @brief Parametric constructor that packs the given values.
+         * @param values The values to pack.
+         */
+        packedarray(const vector<uint64_t> &values);
+        /**
+         * @brief Retrieves an element of the array.
+         * @param pos The position of the desired element. Must be lower
+         *     than the size of the array.
+         * @return The element in the given position.
+         */
+        uint64_t get(size_t pos) const;
+        /**
+         * @brief Retrieves the number of elements of the array.
+         * @return The number of elements.
+         */
+        size_t getSize() const;
+        /**
+         * @brief Retrieves the number of bits taken by each element.
+         * @return The width of the elements.
+         */
+        int getWidth() const;
+        /**
+         * @brief Retrieves the memory taken by the array.
+         * @return The number of bytes.
+         */
+        size_t getBytes() const;
+        /**
+         * @brief Computes the number of bits needed to represent a value.
+         * @param value The given value.
+         * @return The number of bits, at least one.
+         */
+        static int bitsFor(uint64_t value);
+    private:
+        /**
+         * @brief The packed elements.
+         */
+        vector<uint64_t> bits;
+        /**
+         * @brief Number of elements.
+         */
+        size_t size;
+        /**
+         * @brief Number of bits taken by each element.
+         */
+        int width;
+        /**
+         * @brief Mask that keeps the lowest width bits of a word.
+         */
+        uint64_t mask;
+};
+
+#endif
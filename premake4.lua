@@ -22,3 +22,25 @@ project "nlg"
         flags { "Optimize" }
         targetdir "bin/release"
 
+
+project "nlg-bench"
+    kind "ConsoleApp"
+    language "C++"
+    -- Includes
+    includedirs { "include" }
+    -- Sources
+    files { "src/**.cpp", "bench/**.cpp" }
+    excludes { "src/main.cpp" }
+    -- Libraries
+    libdirs { os.findlib("boost_iostreams") }
+    links { "boost_iostreams" }
+
+    configuration "debug"
+        defines { "DEBUG" }
+        flags { "Symbols" }
+        targetdir "bin/debug"
+
+    configuration "release"
+        defines { "NDEBUG" }
+        flags { "Optimize" }
+        targetdir "bin/release"
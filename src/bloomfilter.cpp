@@ -0,0 +1,151 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : bloomfilter.cpp                                             |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#include "bloomfilter.hpp"
+#include "ngram.hpp"
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+bloomfilter::bloomfilter() {
+    nbits = 0;
+    nhashes = 0;
+    queries = 0;
+    rejections = 0;
+    falsePositives = 0;
+}
+
+bloomfilter::bloomfilter(size_t items, double fpr, size_t maxBytes) {
+    const double ln2 = log(2.0);
+    const double minFpr = 1e-9;
+    if (items == 0) {
+        items = 1;
+    }
+    // also catches a NaN rate
+    if (!(fpr >= minFpr)) {
+        fpr = minFpr;
+    } else if (fpr > 1.0) {
+        fpr = 1.0;
+    }
+    double optimal = -(double)items * log(fpr) / (ln2 * ln2);
+    nbits = (optimal < 64.0) ? 64 : (size_t)ceil(optimal);
+    if ((maxBytes > 0) && (nbits > maxBytes * 8)) {
+        nbits = maxBytes * 8;
+    }
+    nhashes = (int)floor((double)nbits / (double)items * ln2 + 0.5);
+    if (nhashes < 1) {
+        nhashes = 1;
+    }
+    bits.assign((nbits + 7) / 8, 0);
+    queries = 0;
+    rejections = 0;
+    falsePositives = 0;
+}
+
+void bloomfilter::insert(const ngram &ng) {
+    uint64_t h1, h2;
+    hash(ng, h1, h2);
+    for (int h = 0; h < nhashes; h++) {
+        uint64_t bit = (h1 + h * h2) % nbits;
+        bits[bit / 8] |= (uint8_t)(1 << (bit % 8));
+    }
+}
+
+bool bloomfilter::contains(const ngram &ng) {
+    queries++;
+    uint64_t h1, h2;
+    hash(ng, h1, h2);
+    for (int h = 0; h < nhashes; h++) {
+        uint64_t bit = (h1 + h * h2) % nbits;
+        if ((bits[bit / 8] & (1 << (bit % 8))) == 0) {
+            rejections++;
+            return false;
+        }
+    }
+    return true;
+}
+
+void bloomfilter::reportFalsePositive() {
+    falsePositives++;
+}
+
+void bloomfilter::resetCounters() {
+    queries = 0;
+    rejections = 0;
+    falsePositives = 0;
+}
+
+size_t bloomfilter::getQueries() const {
+    return queries;
+}
+
+size_t bloomfilter::getRejections() const {
+    return rejections;
+}
+
+size_t bloomfilter::getFalsePositives() const {
+    return falsePositives;
+}
+
+size_t bloomfilter::getBits() const {
+    return nbits;
+}
+
+int bloomfilter::getHashes() const {
+    return nhashes;
+}
+
+size_t bloomfilter::getBytes() const {
+    return sizeof(bloomfilter) + bits.capacity();
+}
+
+// FNV-1a over the tokens, which are separated by a null byte, and a
+// splitmix64 finaliser to derive the second hash
+void bloomfilter::hash(const ngram &ng, uint64_t &h1, uint64_t &h2) {
+    h1 = 14695981039346656037ULL;
+    const vector<string> *grams = ng.getGramList();
+    vector<string>::const_iterator it;
+    for (it = grams->begin(); it != grams->end(); it++) {
+        for (size_t c = 0; c < it->size(); c++) {
+            h1 ^= (unsigned char)(*it)[c];
+            h1 *= 1099511628211ULL;
+        }
+        h1 *= 1099511628211ULL;
+    }
+    h2 = h1 + 0x9e3779b97f4a7c15ULL;
+    h2 = (h2 ^ (h2 >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h2 = (h2 ^ (h2 >> 27)) * 0x94d049bb133111ebULL;
+    h2 = (h2 ^ (h2 >> 31)) | 1;
+}
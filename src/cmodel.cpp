@@ -0,0 +1,235 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : cmodel.cpp                                                  |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#include "cmodel.hpp"
+#include "ngram.hpp"
+#include "packedarray.hpp"
+#include "eliasfano.hpp"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+// sorts the distinct counts by decreasing number of occurrences
+static bool moreFrequent(const pair<int, size_t> &first,
+        const pair<int, size_t> &second) {
+    if (first.second != second.second) {
+        return first.second > second.second;
+    }
+    return first.first < second.first;
+}
+
+cmodel::cmodel() {
+    order = 0;
+}
+
+cmodel::cmodel(const map<ngram, int> &freq, int ord) {
+    order = ord;
+    map<ngram, int>::const_iterator ngit;
+    set<string> tokens;
+    map<int, size_t> occurrences;
+    for (ngit = freq.begin(); ngit != freq.end(); ngit++) {
+        const vector<string> *grams = (ngit->first).getGramList();
+        tokens.insert(grams->begin(), grams->end());
+        occurrences[ngit->second]++;
+    }
+    vocab.assign(tokens.begin(), tokens.end());
+    vector<pair<int, size_t> > byOccurrence(occurrences.begin(),
+        occurrences.end());
+    sort(byOccurrence.begin(), byOccurrence.end(), moreFrequent);
+    map<int, uint64_t> rankOf;
+    for (size_t rank = 0; rank < byOccurrence.size(); rank++) {
+        counts.push_back(byOccurrence[rank].first);
+        rankOf[byOccurrence[rank].first] = rank;
+    }
+    // the map is sorted lexicographically, and so are the identifiers,
+    // hence the n-grams come in trie order
+    vector<vector<uint64_t> > levelIds(order);
+    vector<vector<uint64_t> > levelPtrs(order - 1);
+    vector<uint64_t> levelRanks;
+    vector<uint64_t> prev(order), curr(order);
+    bool first = true;
+    for (ngit = freq.begin(); ngit != freq.end(); ngit++) {
+        for (int level = 0; level < order; level++) {
+            findToken((ngit->first).getGram(level), curr[level]);
+        }
+        int diverge = 0;
+        if (!first) {
+            while ((diverge < order - 1) &&
+                    (curr[diverge] == prev[diverge])) {
+                diverge++;
+            }
+        }
+        for (int level = diverge; level < order; level++) {
+            levelIds[level].push_back(curr[level]);
+            if (level < order - 1) {
+                levelPtrs[level].push_back(levelIds[level + 1].size());
+            }
+        }
+        levelRanks.push_back(rankOf[ngit->second]);
+        prev.swap(curr);
+        first = false;
+    }
+    for (int level = 0; level < order; level++) {
+        ids.push_back(packedarray(levelIds[level]));
+        if (level < order - 1) {
+            levelPtrs[level].push_back(levelIds[level + 1].size());
+            ptrs.push_back(eliasfano(levelPtrs[level]));
+        }
+    }
+    ranks = packedarray(levelRanks);
+}
+
+int cmodel::getOrder() const {
+    return order;
+}
+
+size_t cmodel::getSize() const {
+    return ranks.getSize();
+}
+
+size_t cmodel::getBytes() const {
+    size_t bytes = sizeof(cmodel) - sizeof(packedarray);
+    vector<string>::const_iterator tokit;
+    for (tokit = vocab.begin(); tokit != vocab.end(); tokit++) {
+        bytes += sizeof(string) + tokit->size();
+    }
+    for (size_t level = 0; level < ids.size(); level++) {
+        bytes += ids[level].getBytes();
+    }
+    for (size_t level = 0; level < ptrs.size(); level++) {
+        bytes += ptrs[level].getBytes();
+    }
+    bytes += ranks.getBytes() + counts.capacity() * sizeof(int);
+    return bytes;
+}
+
+int cmodel::getCount(const ngram &ng) const {
+    size_t first, last, pos;
+    uint64_t id;
+    if (descend(ng, order - 1, first, last) &&
+            findToken(ng.getGram(order - 1), id) &&
+            findChild(order - 1, first, last, id, pos)) {
+        return counts[ranks.get(pos)];
+    }
+    return 0;
+}
+
+bool cmodel::findHistory(const ngram &hist, size_t &first,
+        size_t &last) const {
+    return descend(hist, order - 1, first, last);
+}
+
+void cmodel::getHistories(vector<ngram> &hists) const {
+    if (order > 1) {
+        vector<string> path;
+        collect(0, 0, ids[0].getSize(), order - 1, path, hists);
+    }
+}
+
+string cmodel::sample(size_t first, size_t last, int rnd) const {
+    int totalc = 0;
+    for (size_t leaf = first; leaf < last; leaf++) {
+        totalc += counts[ranks.get(leaf)];
+    }
+    int choice = (rnd % totalc) + 1;
+    size_t leaf;
+    for (leaf = first; leaf < last - 1; leaf++) {
+        choice -= counts[ranks.get(leaf)];
+        if (choice <= 0) {
+            break;
+        }
+    }
+    return vocab[ids[order - 1].get(leaf)];
+}
+
+bool cmodel::findToken(const string &token, uint64_t &id) const {
+    vector<string>::const_iterator tokit = lower_bound(vocab.begin(),
+        vocab.end(), token);
+    if ((tokit == vocab.end()) || (*tokit != token)) {
+        return false;
+    }
+    id = tokit - vocab.begin();
+    return true;
+}
+
+bool cmodel::findChild(int level, size_t first, size_t last,
+        uint64_t id, size_t &pos) const {
+    while (first < last) {
+        size_t middle = first + (last - first) / 2;
+        uint64_t value = ids[level].get(middle);
+        if (value < id) {
+            first = middle + 1;
+        } else if (value > id) {
+            last = middle;
+        } else {
+            pos = middle;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cmodel::descend(const ngram &ng, int depth, size_t &first,
+        size_t &last) const {
+    first = 0;
+    last = (order > 0) ? ids[0].getSize() : 0;
+    size_t pos;
+    uint64_t id;
+    for (int level = 0; level < depth; level++) {
+        if (!findToken(ng.getGram(level), id) ||
+                !findChild(level, first, last, id, pos)) {
+            return false;
+        }
+        first = ptrs[level].get(pos);
+        last = ptrs[level].get(pos + 1);
+    }
+    return true;
+}
+
+void cmodel::collect(int level, size_t first, size_t last, int depth,
+        vector<string> &path, vector<ngram> &hists) const {
+    for (size_t node = first; node < last; node++) {
+        path.push_back(vocab[ids[level].get(node)]);
+        if (level == depth - 1) {
+            hists.push_back(ngram(path));
+        } else {
+            collect(level + 1, ptrs[level].get(node),
+                ptrs[level].get(node + 1), depth, path, hists);
+        }
+        path.pop_back();
+    }
+}
@@ -0,0 +1,105 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : eliasfano.cpp                                               |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#include "eliasfano.hpp"
+#include "packedarray.hpp"
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+eliasfano::eliasfano() {
+    size = 0;
+    lowWidth = 0;
+}
+
+eliasfano::eliasfano(const vector<uint64_t> &values) {
+    size = values.size();
+    lowWidth = 0;
+    if (size == 0) {
+        return;
+    }
+    uint64_t universe = values[size - 1] + 1;
+    while (((universe / size) >> (lowWidth + 1)) != 0) {
+        lowWidth++;
+    }
+    vector<uint64_t> lowValues(size);
+    uint64_t lowMask = ((uint64_t)1 << lowWidth) - 1;
+    size_t nbits = size + (size_t)(universe >> lowWidth) + 1;
+    high.assign((nbits + 63) / 64, 0);
+    for (size_t pos = 0; pos < size; pos++) {
+        lowValues[pos] = values[pos] & lowMask;
+        uint64_t bit = (values[pos] >> lowWidth) + pos;
+        high[bit / 64] |= (uint64_t)1 << (bit % 64);
+        if ((pos % 64) == 0) {
+            samples.push_back(bit);
+        }
+    }
+    if (lowWidth > 0) {
+        low = packedarray(lowValues);
+    }
+}
+
+uint64_t eliasfano::get(size_t pos) const {
+    uint64_t value = (select(pos) - pos) << lowWidth;
+    if (lowWidth > 0) {
+        value |= low.get(pos);
+    }
+    return value;
+}
+
+size_t eliasfano::getSize() const {
+    return size;
+}
+
+size_t eliasfano::getBytes() const {
+    return sizeof(eliasfano) - sizeof(packedarray) + low.getBytes() +
+        (high.capacity() + samples.capacity()) * sizeof(uint64_t);
+}
+
+uint64_t eliasfano::select(size_t rank) const {
+    uint64_t start = samples[rank / 64];
+    size_t remaining = rank % 64;
+    size_t word = (size_t)(start / 64);
+    uint64_t current = high[word] & (~(uint64_t)0 << (start % 64));
+    int ones = __builtin_popcountll(current);
+    while (remaining >= (size_t)ones) {
+        remaining -= ones;
+        word++;
+        current = high[word];
+        ones = __builtin_popcountll(current);
+    }
+    for (; remaining > 0; remaining--) {
+        current &= current - 1;
+    }
+    return (uint64_t)word * 64 + __builtin_ctzll(current);
+}
@@ -31,6 +31,8 @@
 
 #include "generator.hpp"
 #include "ngram.hpp"
+#include "cmodel.hpp"
+#include "bloomfilter.hpp"
 #include <string>
 #include <map>
 #include <boost/tokenizer.hpp>
@@ -44,12 +46,16 @@ using namespace boost;
 
 generator::generator() {
     order = 0;
+    compressed = false;
+    filtered = false;
     srand(time(0));
     rc = rand() % 50;
 }
 
 generator::generator(int ord) {
     order = ord;
+    compressed = false;
+    filtered = false;
     srand(time(0));
     rc = rand() % 50;
 }
@@ -63,6 +69,9 @@ int generator::getOrder() const {
 }
 
 void generator::feed(const string &food) {
+    if (compressed) {
+        return;
+    }
     string theFood = food;
     vector<string> frame(order, RESERVED_TAG_START);
     theFood += " " + RESERVED_TAG_END;
@@ -74,14 +83,116 @@ void generator::feed(const string &food) {
         frame[order - 1] = *beg;
         ngram ngframe(frame);
         freq[ngframe]++;
+        if (filtered) {
+            filter.insert(ngram(vector<string>(frame.begin(),
+                frame.end() - 1)));
+        }
+    }
+}
+
+void generator::compress() {
+    if (compressed) {
+        return;
+    }
+    cfreq = cmodel(freq, order);
+    map<ngram, int>().swap(freq);
+    compressed = true;
+}
+
+bool generator::isCompressed() const {
+    return compressed;
+}
+
+const map<ngram, int>* generator::getFreq() const {
+    return &freq;
+}
+
+const cmodel* generator::getCompressed() const {
+    return &cfreq;
+}
+
+void generator::buildFilter(double fpr, size_t maxBytes) {
+    if ((order < 2) || !((fpr > 0.0) && (fpr < 1.0))) {
+        return;
+    }
+    vector<ngram> hists;
+    if (compressed) {
+        cfreq.getHistories(hists);
+    } else {
+        vector<string> prev;
+        map<ngram, int>::const_iterator ngit;
+        for (ngit = freq.begin(); ngit != freq.end(); ngit++) {
+            const vector<string> *grams = (ngit->first).getGramList();
+            vector<string> hist(grams->begin(), grams->end() - 1);
+            if (hists.empty() || (hist != prev)) {
+                hists.push_back(ngram(hist));
+                prev = hist;
+            }
+        }
+    }
+    filter = bloomfilter(hists.size(), fpr, maxBytes);
+    vector<ngram>::const_iterator histit;
+    for (histit = hists.begin(); histit != hists.end(); histit++) {
+        filter.insert(*histit);
     }
+    filtered = true;
+}
+
+bool generator::isFiltered() const {
+    return filtered;
+}
+
+const bloomfilter* generator::getFilter() const {
+    return &filter;
+}
+
+void generator::resetFilterCounters() {
+    filter.resetCounters();
+}
+
+bool generator::isObserved(const ngram &hist) {
+    if (order < 2) {
+        return true;
+    }
+    if (!mayBeObserved(hist)) {
+        return false;
+    }
+    bool found;
+    if (compressed) {
+        size_t first, last;
+        found = cfreq.findHistory(hist, first, last);
+    } else {
+        found = (lower(hist) != upper(hist));
+    }
+    if (!found && filtered) {
+        filter.reportFalsePositive();
+    }
+    return found;
 }
 
 string generator::predict(const ngram &hist) {
+    bool unseen = (order > 1) && !mayBeObserved(hist);
+    if (compressed) {
+        size_t first = 0;
+        size_t last = cfreq.getSize();
+        size_t histFirst, histLast;
+        if ((order > 1) && !unseen) {
+            if (cfreq.findHistory(hist, histFirst, histLast)) {
+                first = histFirst;
+                last = histLast;
+            } else if (filtered) {
+                filter.reportFalsePositive();
+            }
+        }
+        return cfreq.sample(first, last, randNum());
+    }
     map<ngram, int> workingMap;
-    if (order > 1) {
+    if ((order > 1) && !unseen) {
         map<ngram, int> submap(lower(hist), upper(hist));
         if (submap.empty()) {
+            if (filtered) {
+                filter.reportFalsePositive();
+            }
             workingMap = freq;
         } else {
             workingMap = submap;
@@ -156,6 +267,10 @@ map<ngram, int>::const_iterator generator::upper (const ngram& ng) const {
     return it;
 }
 
+bool generator::mayBeObserved(const ngram &hist) {
+    return !filtered || filter.contains(hist);
+}
+
 int generator::randNum() {
     rc = (rc + 1) % 50;
     return randy[rc];
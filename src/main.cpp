@@ -57,12 +57,20 @@ void printSynopsis() {
     cout << "Usage: nlg PARAMETERS" << endl;
     cout << "\t-n ORDER: the order of the language model." << endl;
     cout << "\t-t FILE: the training file." << endl;
+    cout << "\t-c FLAG: compress the model after training, 1 for yes "
+        "(optional, 0 by default)." << endl;
+    cout << "\t-f RATE: filter the unseen histories with a Bloom filter of "
+        "the given" << endl << "\t\tfalse positive rate, e.g., 0.01 "
+        "(optional, no filter by default)." << endl;
+    cout << "\t-m BYTES: limit the bit array of the Bloom filter to the "
+        "given size" << endl << "\t\t(optional, no limit by default)." <<
+        endl;
     cout << endl;
     cout << "Then, nlg will yield one output at a time." << endl << endl;
 }
 
 int main(int argc, const char* argv[]) {
-    if (argc == 5) {
+    if ((argc >= 5) && (argc <= 11) && ((argc % 2) == 1)) {
         map<string, string> opts = getOptionMap(argc, argv);
         generator gen(atoi(opts["-n"].c_str()));
         ifstream training(opts["-t"].c_str());
@@ -77,6 +85,11 @@ int main(int argc, const char* argv[]) {
             getline(training, line);
         }
         training.close();
+        gen.buildFilter(atof(opts["-f"].c_str()),
+            strtoul(opts["-m"].c_str(), NULL, 10));
+        if (atoi(opts["-c"].c_str()) == 1) {
+            gen.compress();
+        }
         line = "y";
         while (line != "n") {
             cout << gen.produce() << endl;
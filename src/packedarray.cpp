@@ -0,0 +1,97 @@
+/*
+     ____  _____    _____         ______
+    |_   \|_   _|  |_   _|      .' ___  |
+      |   \ | |      | |       / .'   \_|
+      | |\ \| |      | |   _   | |    ____
+     _| |_\   |_    _| |__/ |  \ `.___]  _|
+ ___|     |\_   |__|        |___'.      |_______________________________
+|                                                                      |\
+|                                                                      |_\
+|   File    : packedarray.cpp                                             |
+|   Created : 18-Oct-2026                                                 |
+|   By      : agent                                                       |
+|                                                                         |
+|   NLG - Natural Language Generator based on n-gram Language Models      |
+|                                                                         |
+|   Copyright (c) 2026 NLG contributors                                   |
+|                                                                         |
+|   -------------------------------------------------------------------   |
+|                                                                         |
+|   This file is part of NLG.                                             |
+|                                                                         |
+|   NLG is free software: you can redistribute it and/or modify it under  |
+|   the terms of the MIT/X11 License as published by the Massachusetts    |
+|   Institute of Technology. See the MIT/X11 License for more details.    |
+|                                                                         |
+|   You should have received a copy of the MIT/X11 License along with     |
+|   this source code distribution of NLG (see the COPYING                 |
+|   file in the root directory). If not, see                              |
+|   <http://www.opensource.org/licenses/mit-license>.                     |
+|________________________________________________________________________*/
+
+#include "packedarray.hpp"
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+packedarray::packedarray() {
+    size = 0;
+    width = 1;
+    mask = 1;
+}
+
+packedarray::packedarray(const vector<uint64_t> &values) {
+    uint64_t maxval = 0;
+    vector<uint64_t>::const_iterator it;
+    for (it = values.begin(); it != values.end(); it++) {
+        if (*it > maxval) {
+            maxval = *it;
+        }
+    }
+    size = values.size();
+    width = bitsFor(maxval);
+    mask = (width == 64) ? ~(uint64_t)0 : (((uint64_t)1 << width) - 1);
+    bits.assign((size * width + 63) / 64, 0);
+    for (size_t pos = 0; pos < size; pos++) {
+        size_t bit = pos * width;
+        size_t word = bit / 64;
+        int offset = (int)(bit % 64);
+        bits[word] |= values[pos] << offset;
+        if (offset + width > 64) {
+            bits[word + 1] |= values[pos] >> (64 - offset);
+        }
+    }
+}
+
+uint64_t packedarray::get(size_t pos) const {
+    size_t bit = pos * width;
+    size_t word = bit / 64;
+    int offset = (int)(bit % 64);
+    uint64_t value = bits[word] >> offset;
+    if (offset + width > 64) {
+        value |= bits[word + 1] << (64 - offset);
+    }
+    return value & mask;
+}
+
+size_t packedarray::getSize() const {
+    return size;
+}
+
+int packedarray::getWidth() const {
+    return width;
+}
+
+size_t packedarray::getBytes() const {
+    return sizeof(packedarray) + bits.capacity() * sizeof(uint64_t);
+}
+
+int packedarray::bitsFor(uint64_t value) {
+    int nbits = 1;
+    while ((nbits < 64) && ((value >> nbits) != 0)) {
+        nbits++;
+    }
+    return nbits;
+}